@@ -17,18 +17,43 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <memory>
 
 #include "rcsb_types.h"
 #include "GenString.h"
 #include "SchemaMap.h"
+#include "SchemaMapSnapshot.h"
 #include "DictObjCont.h"
 #include "DictDataInfo.h"
 
 
+/**
+**  \class SchemaDataInfo
+**
+**  \brief Data information of the schema tables.
+**
+**  Schema information is read from a read-only snapshot of the schema
+**  mapping information and category keys are computed on construction,
+**  so the object keeps no per-query state. After construction, one object
+**  can be queried by a number of threads, provided that the dictionary
+**  object container can.
+*/
 class SchemaDataInfo : public DictDataInfo
 {
   public:
+    /**
+    **  Constructs the data information from a snapshot of a schema mapping
+    **  object, taken at construction.
+    */
     SchemaDataInfo(SchemaMap& schemaMap, const DictObjCont& dictObjCont);
+
+    /**
+    **  Constructs the data information from a published snapshot, which
+    **  can be shared with other readers.
+    */
+    SchemaDataInfo(std::shared_ptr<const SchemaMapSnapshot> snapshot,
+      const DictObjCont& dictObjCont);
     ~SchemaDataInfo();
 
     void GetVersion(std::string& version);
@@ -75,21 +100,86 @@ class SchemaDataInfo : public DictDataInfo
     void GetParentCifItems(std::vector<std::string>& parCifItems,
       const std::string& cifItemName);
 
+    /*!
+    **  Finds the ID of a category. Category IDs index GetCatNames().
+    **
+    **  \param[out] catId - ID of the category
+    **  \param[in] catName - the name of the category
+    **
+    **  \return true - if category is defined
+    **  \return false - otherwise
+    */
+    bool FindCat(unsigned int& catId, const std::string& catName) const;
+
+    /*!
+    **  Finds the ID of an item. Item IDs index GetItemsNames().
+    **
+    **  \param[out] itemId - ID of the item
+    **  \param[in] itemName - the CIF name of the item
+    **
+    **  \return true - if item is defined
+    **  \return false - otherwise
+    */
+    bool FindItem(unsigned int& itemId, const std::string& itemName) const;
+
+    /*!
+    **  Retrieves the item IDs of a category. Items of a category have
+    **  contiguous IDs.
+    **
+    **  \param[out] beginItemId - ID of the first item of the category
+    **  \param[out] endItemId - ID past the last item of the category
+    **  \param[in] catId - ID of the category
+    **
+    **  \return None
+    */
+    void GetCatItemIds(unsigned int& beginItemId, unsigned int& endItemId,
+      const unsigned int catId) const;
+
+    /*!
+    **  Retrieves the ID of the category of an item.
+    **
+    **  \param[in] itemId - ID of the item
+    **
+    **  \return ID of the item category
+    */
+    unsigned int GetItemCatId(const unsigned int itemId) const;
+
+    /*!
+    **  Retrieves the attribute name of an item.
+    **
+    **  \param[in] itemId - ID of the item
+    **
+    **  \return Attribute name, i.e. the item name without the category
+    */
+    const std::string& GetItemAttribName(const unsigned int itemId) const;
+
   private:
-    SchemaMap& _schemaMap;
+    typedef std::unordered_map<std::string, unsigned int> SymbolIndex;
+
+    std::shared_ptr<const SchemaMapSnapshot> _snapshot;
 
     std::vector<std::string> _catNames;
     std::vector<std::string> _itemNames;
 
-    std::string _catName;
-    std::vector<std::string> _catKeys;
-    std::vector<AttrInfo> _attrInfo;
+    SymbolIndex _catIndex;
+    SymbolIndex _itemIndex;
+
+    // Item ID spans, items of category i are [_catItemsBegin[i],
+    // _catItemsBegin[i + 1])
+    std::vector<unsigned int> _catItemsBegin;
+    std::vector<unsigned int> _itemCats;
+    std::vector<std::string> _itemAttribNames;
+
+    // Key items of all the schema tables. On duplicate names, the first
+    // definition is the one that applies.
+    std::unordered_map<std::string, std::vector<std::string> > _catKeys;
+    std::vector<std::string> _noCatKeys;
 
     std::vector<std::string> _itemAttrib;
 
 
+    void _Init();
     bool _IsSpecialAttribute(const std::string& attribName);
-    void _GetCatAttribsInfo(const std::string& catName);
 };
 
 
@@ -0,0 +1,243 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaDictIndex.h
+**
+** \brief Header file for SchemaDictIndex class.
+*/
+
+
+#ifndef SCHEMADICTINDEX_H
+#define SCHEMADICTINDEX_H
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "GenString.h"
+#include "ISTable.h"
+
+
+/**
+**  \class SchemaDictIndex
+**
+**  \brief Public class that represents hash indices of the dictionary DDL
+**    tables, that are used in creating the schema mapping information.
+**
+**  This class reads the DDL tables of a dictionary once and indexes them
+**  by item name and category name, so that each dictionary lookup done
+**  while creating the schema mapping information is a single hash lookup,
+**  instead of a table search. Top parents of items are precomputed. Index
+**  keys are compared in the same way as the DDL tables compare them, i.e.
+**  case-sensitively, except for the alias index, which is, as in the
+**  alias searches, case-insensitive.
+*/
+class SchemaDictIndex
+{
+  public:
+    /**
+    **  Constructs a dictionary index.
+    **
+    **  \param[in] itemTypeTab - reference to "item_type" DDL table
+    **  \param[in] itemLinkedTab - reference to "item_linked" DDL table
+    **  \param[in] itemDescriptionTab - reference to "item_description" DDL
+    **    table
+    **  \param[in] itemExamplesTab - reference to "item_examples" DDL table
+    **  \param[in] categoryTab - reference to "category" DDL table
+    **  \param[in] categoryGroupTab - reference to "category_group" DDL table
+    **  \param[in] categoryKeyTab - reference to "category_key" DDL table
+    **  \param[in] itemTab - reference to "item" DDL table
+    **
+    **  \return Not applicable
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    SchemaDictIndex(ISTable& itemTypeTab, ISTable& itemLinkedTab,
+      ISTable& itemDescriptionTab, ISTable& itemExamplesTab,
+      ISTable& categoryTab, ISTable& categoryGroupTab,
+      ISTable& categoryKeyTab, ISTable& itemTab);
+
+    ~SchemaDictIndex();
+
+    /**
+    **  Indexes item aliases of the "cif_rcsb.dic" version "1.1"
+    **  dictionary. For "alias" operation, items are mapped to their alias
+    **  names and for "unalias" operation, alias names are mapped to item
+    **  names. Any previous alias index is replaced.
+    **
+    **  \param[in] itemAliasesTab - reference to "item_aliases" DDL table
+    **  \param[in] op - "alias" or "unalias"
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void IndexAliases(ISTable& itemAliasesTab, const string& op);
+
+    bool GetTypeCode(string& typeCode, const string& itemName) const;
+
+    /**
+    **  Retrieves the first parent of an item.
+    **
+    **  \param[out] parentName - the name of the first parent item, empty if
+    **    item has no parents.
+    **  \param[in] itemName - the name of the item
+    **
+    **  \return Number of parents of the item
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    unsigned int GetParentName(string& parentName,
+      const string& itemName) const;
+
+    /**
+    **  Retrieves the top parent of an item, obtained by following the first
+    **  parent of each item in the parent chain.
+    **
+    **  \param[out] topParentName - the name of the top parent item, empty
+    **    if item has no parents.
+    **  \param[in] itemName - the name of the item
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void GetTopParentName(string& topParentName,
+      const string& itemName) const;
+
+    bool GetCategoryDescription(string& categoryDescription,
+      const string& category) const;
+
+    /**
+    **  Retrieves the last group of a category.
+    **
+    **  \param[out] categoryGroup - the name of the last category group
+    **  \param[in] category - the name of the category
+    **
+    **  \return Number of groups of the category
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    unsigned int GetCategoryGroup(string& categoryGroup,
+      const string& category) const;
+
+    const vector<string>& GetCategoryKeys(const string& category) const;
+    const vector<string>& GetCategoryItems(const string& category) const;
+
+    bool GetItemDescription(string& itemDescription,
+      const string& itemName) const;
+    bool GetFirstItemExample(string& firstItemExample,
+      const string& itemName) const;
+
+    bool GetAliasName(string& aliasName, const string& itemName) const;
+
+    /**
+    **  Retrieves the definition of a category, which consists of all the
+    **  category information that is used in creating the schema mapping
+    **  information, except its items: description, groups and keys. A
+    **  category is defined in the same way in two dictionaries, if its
+    **  definitions are equal.
+    **
+    **  \param[out] definition - category definition
+    **  \param[in] category - the name of the category
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void GetCategoryDefinition(string& definition,
+      const string& category) const;
+
+    /**
+    **  Retrieves the definition of an item, which consists of all the item
+    **  information that is used in creating the schema mapping information:
+    **  type code, top parent and its type code, description, first example
+    **  and alias name.
+    **
+    **  \param[out] definition - item definition
+    **  \param[in] itemName - the name of the item
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void GetItemDefinition(string& definition, const string& itemName) const;
+
+  private:
+    typedef std::unordered_map<string, string> NameMap;
+    typedef std::unordered_map<string, vector<string> > NamesMap;
+
+    typedef struct
+    {
+        string parentName;
+        unsigned int numParents;
+        string topParentName;
+    } ParentInfo;
+
+    typedef struct
+    {
+        string lastGroup;
+        unsigned int numGroups;
+    } GroupInfo;
+
+    NameMap _typeCodes;
+    std::unordered_map<string, ParentInfo> _parents;
+    NameMap _catDescriptions;
+    std::unordered_map<string, GroupInfo> _catGroups;
+    NamesMap _catKeys;
+    NamesMap _catItems;
+    NameMap _itemDescriptions;
+    NameMap _itemExamples;
+    NameMap _aliases;
+
+    static const vector<string> _emptyNames;
+
+    static void _IndexFirst(NameMap& index, ISTable& table,
+      const string& keyColName, const string& valueColName);
+    static void _IndexAll(NamesMap& index, ISTable& table,
+      const string& keyColName, const string& valueColName);
+
+    void _ResolveTopParents();
+
+    static void _AppendField(string& definition, const string& value,
+      const bool found);
+
+    SchemaDictIndex(const SchemaDictIndex&);
+    SchemaDictIndex& operator=(const SchemaDictIndex&);
+};
+
+
+#endif
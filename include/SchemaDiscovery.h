@@ -0,0 +1,147 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaDiscovery.h
+**
+** \brief Header file for SchemaDiscovery class.
+*/
+
+
+#ifndef SCHEMADISCOVERY_H
+#define SCHEMADISCOVERY_H
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "GenString.h"
+
+
+/**
+**  \class SchemaDiscovery
+**
+**  \brief Public class that discovers the tables and columns, that are
+**    present in a number of CIF files.
+**
+**  This class scans CIF files as a stream of tokens and records only the
+**  names of data items, i.e. table and column names, while all the values,
+**  including loop bodies and text fields, are skipped without being
+**  stored. Memory used is therefore bounded by the size of the discovered
+**  schema and not by the size of the data. Files can be scanned in
+**  parallel. The discovered tables and columns are the union of the
+**  tables and columns of all the files, in the order of their first
+**  appearance, when files are taken in the order they were added.
+*/
+class SchemaDiscovery
+{
+  public:
+    /**
+    **  Constructs a schema discovery object.
+    **
+    **  \param[in] verbose - optional parameter that indicates whether
+    **    logging should be turned on (if true) or off (if false).
+    **    If \e verbose is not specified, logging is turned off.
+    **
+    **  \return Not applicable
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    SchemaDiscovery(const bool verbose = false);
+
+    ~SchemaDiscovery();
+
+    void AddFile(const string& fileName);
+    void AddFiles(const vector<string>& fileNames);
+
+    /**
+    **  Adds all the files from a directory, whose names end with the
+    **  specified suffix. Files are added in the order of their names.
+    **
+    **  \param[in] dirName - the name of the directory
+    **  \param[in] suffix - optional file name suffix. If not specified,
+    **    ".cif" files are added.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if directory cannot be opened
+    */
+    void AddDirectory(const string& dirName,
+      const string& suffix = string(".cif"));
+
+    /**
+    **  Scans all the added files and discovers their tables and columns.
+    **  Each thread scans a contiguous range of files and the results are
+    **  merged in the file order, so that they do not depend on the number
+    **  of threads.
+    **
+    **  \param[in] numThreads - optional parameter that indicates the number
+    **    of threads to use. If not specified, one thread is used.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if a file cannot be opened
+    */
+    void Scan(const unsigned int numThreads = 1);
+
+    /**
+    **  Retrieves the discovered tables and columns.
+    **
+    **  \param[out] tableList - the names of the discovered tables
+    **  \param[out] allColNames - for each table, the names of its columns
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void GetTablesAndColumns(vector<string>& tableList,
+      vector<vector<string> >& allColNames) const;
+
+  private:
+    // Ordered union of table and column names
+    typedef struct
+    {
+        vector<string> tables;
+        std::unordered_map<string, unsigned int> tableIndex;
+        vector<vector<string> > columns;
+        vector<std::unordered_set<string> > columnSets;
+    } Names;
+
+    bool _verbose;
+
+    vector<string> _fileNames;
+
+    Names _names;
+
+    void _ScanFiles(Names& names, const unsigned int fromFileI,
+      const unsigned int toFileI, string& diags) const;
+    void _ScanFile(Names& names, const string& fileName, string& diags) const;
+
+    static void _AddName(Names& names, const string& tableName,
+      const string& colName);
+    static void _MergeNames(Names& names, const Names& otherNames);
+};
+
+
+#endif
@@ -16,6 +16,12 @@
 
 
 #include <string>
+#include <vector>
+#include <sstream>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <unordered_map>
 
 #include "GenString.h"
 #include "CifFile.h"
@@ -34,6 +40,94 @@ typedef struct
 } AttrInfo;
 
 
+// Column binding flags
+const unsigned char eBIND_MAPPED = 0x01;   // Column is a schema attribute
+const unsigned char eBIND_KEY = 0x02;      // Attribute is a key attribute
+const unsigned char eBIND_REQUIRED = 0x04; // Attribute value must not be null
+
+/**
+**  Column binding plan. Binds the columns of an input table, in their
+**  order, to the schema attributes of the table.
+*/
+typedef struct
+{
+    string tableName;
+    vector<string> columnsNames;
+    Char::eCompareType compareType;
+    vector<int> attribIndices;  // Per column, index in table attributes or -1
+    vector<unsigned char> flags;  // Per column, eBIND_* flags
+    vector<unsigned int> unmappedColumns;  // Indices of unmapped columns
+} BindingPlan;
+
+
+class SchemaMapSnapshot;
+class SchemaDictIndex;
+
+
+/**
+**  \class SchemaRowWriter
+**
+**  \brief Public interface of a consumer of created table rows.
+**
+**  Rows of the tables that SchemaMap creates can be passed, as they are
+**  created, to an implementation of this interface, instead of being
+**  collected in a table.
+*/
+class SchemaRowWriter
+{
+  public:
+    virtual ~SchemaRowWriter() {};
+
+    virtual void Begin(const string& tableName,
+      const vector<string>& columnsNames) = 0;
+    virtual void WriteRow(const vector<string>& row) = 0;
+    virtual void End() = 0;
+};
+
+
+/**
+**  \class TableRowWriter
+**
+**  \brief Public class that collects created table rows in a table.
+**
+**  The table is created on Begin() and is owned by the caller of
+**  GetTable().
+*/
+class TableRowWriter : public SchemaRowWriter
+{
+  public:
+    TableRowWriter() : _table(NULL) {};
+
+    void Begin(const string& tableName, const vector<string>& columnsNames)
+    {
+        _table = new ISTable(tableName);
+
+        for (unsigned int i = 0; i < columnsNames.size(); ++i)
+        {
+            _table->AddColumn(columnsNames[i]);
+        }
+    }
+
+    void WriteRow(const vector<string>& row)
+    {
+        _table->AddRow(row);
+    }
+
+    void End()
+    {
+
+    }
+
+    ISTable* GetTable()
+    {
+        return (_table);
+    }
+
+  private:
+    ISTable* _table;
+};
+
+
 /**
 **  \class SchemaMap
 **
@@ -78,6 +172,16 @@ class SchemaMap
     **  \param[in] verbose - optional parameter that indicates whether
     **    logging should be turned on (if true) or off (if false).
     **    If \e verbose is not specified, logging is turned off.
+    **  \param[in] slim - optional parameter that indicates whether only the
+    **    tables needed for loading data should be kept in memory. If true
+    **    and only \e schemaFile is specified, the description and view
+    **    tables ("rcsb_table_description", "rcsb_attribute_description"
+    **    and "rcsb_attribute_view") are dropped after parsing and are
+    **    parsed again on their first use, i.e. when table or column info
+    **    is created, or schema mapping information is regenerated or
+    **    written. Slim mode is ignored if \e schemaFileOdb is specified,
+    **    since the tables cannot be parsed again from it. If not specified,
+    **    all tables are kept.
     **
     **  \return Not applicable
     **
@@ -88,13 +192,101 @@ class SchemaMap
     **  \exception: None
     */
     SchemaMap(const string& schemaFile = std::string(),
-      const string& schemaFileOdb = std::string(), bool verbose = false);
+      const string& schemaFileOdb = std::string(), bool verbose = false,
+      const bool slim = false);
 
     SchemaMap(const eFileMode fileMode, const string& dictSdbFileName,
       const bool verbose);
 
+    /**
+    **  Creates the schema mapping information from the dictionary.
+    **
+    **  \param[in] op - "standard", "alias" or "unalias" operation
+    **  \param[in] inFile - optional name of the CIF file, whose tables and
+    **    columns are mapped. If empty, all dictionary categories are mapped.
+    **  \param[in] structId - the source of structure identifier
+    **  \param[in] numThreads - optional parameter that indicates the number
+    **    of threads to use. If not specified, one thread is used. Categories
+    **    are processed in parallel, while the created schema mapping
+    **    information and the log output are the same as with one thread.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
     void Create(const string& op, const string& inFile,
-      const string& structId);
+      const string& structId, const unsigned int numThreads = 1);
+
+    /**
+    **  Creates the schema mapping information from the dictionary, for
+    **  the union of tables and columns found in a number of CIF files.
+    **  Files are scanned as streams, only for table and column names, so
+    **  their size does not matter.
+    **
+    **  \param[in] op - "standard", "alias" or "unalias" operation
+    **  \param[in] inFiles - the names of the CIF files, whose tables and
+    **    columns are mapped. Directories can also be specified, in which
+    **    case all their ".cif" files are scanned. If empty, all dictionary
+    **    categories are mapped.
+    **  \param[in] structId - the source of structure identifier
+    **  \param[in] numThreads - optional parameter that indicates the number
+    **    of threads to use, for both scanning the files and creating the
+    **    schema mapping information. If not specified, one thread is used.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if a file cannot be scanned
+    */
+    void Create(const string& op, const vector<string>& inFiles,
+      const string& structId, const unsigned int numThreads = 1);
+
+    /**
+    **  Incrementally regenerates the schema mapping information, that has
+    **  been created from a dictionary, for a new version of the
+    **  dictionary. Categories and items of the two dictionary versions are
+    **  compared and only the rows of the added and changed categories are
+    **  created again. Rows of the unchanged categories are kept as they
+    **  are and rows of the removed categories are removed. Widths and
+    **  populated flags of the unchanged items of changed categories are
+    **  kept. Table order is kept, with added categories at the end, in
+    **  the dictionary order. Tables that are in neither dictionary version
+    **  are kept.
+    **
+    **  \param[in] op - "standard", "alias" or "unalias" operation, that the
+    **    schema mapping information has been created with
+    **  \param[in] oldDictSdbFileName - the name of the serialized
+    **    dictionary file, that the schema mapping information has been
+    **    created from
+    **  \param[in] newDictSdbFileName - the name of the serialized new
+    **    dictionary file
+    **  \param[in] structId - the source of structure identifier of the added
+    **    categories. If empty, it is taken from the existing tables.
+    **  \param[in] diffFileName - optional name of the CIF file, to which
+    **    the added, removed and changed categories and items are written.
+    **    If empty, differences are not written.
+    **  \param[in] numThreads - optional parameter that indicates the number
+    **    of threads to use. If not specified, one thread is used.
+    **
+    **  \return None
+    **
+    **  \pre Schema mapping information has been read from a file.
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if a dictionary DDL table is missing
+    */
+    void Regenerate(const string& op, const string& oldDictSdbFileName,
+      const string& newDictSdbFileName, const string& structId,
+      const string& diffFileName = std::string(),
+      const unsigned int numThreads = 1);
 
     void Write(const string& fileName);
 
@@ -184,6 +376,34 @@ class SchemaMap
     */
     void updateSchemaMapDetails(SchemaMap& revSchMap);
 
+    /**
+    **  Updates the existing schema mapping object, with the revised
+    **  information from a number of revised schema mapping files. The
+    **  revised attribute definitions are read with a scanner that keeps
+    **  no global state, so the files are both read and joined against
+    **  this object in parallel. Attribute width becomes the maximum of
+    **  all the widths and attribute is populated if it is populated in any
+    **  of the maps.
+    **  Memory used is proportional to the number of attributes and the
+    **  number of threads, and not to the number of revised files.
+    **
+    **  \param[in] revSchemaFiles - the names of the revised schema mapping
+    **    ASCII CIF files.
+    **  \param[in] numThreads - optional parameter that indicates the number
+    **    of threads to use. If not specified, one thread is used.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if a revised file cannot be read or
+    **    its attribute definitions are incomplete
+    */
+    void updateSchemaMapDetails(const vector<string>& revSchemaFiles,
+      const unsigned int numThreads = 1);
+
     /**
     **  In the specified CIF file object, creates tables that are specified in
     **  the schema mapping object.
@@ -229,6 +449,38 @@ class SchemaMap
     ISTable* CreateTableInfo();
     ISTable* CreateColumnInfo();
 
+    /**
+    **  Creates "rcsb_tableinfo" table rows and passes them to a writer,
+    **  without building the table.
+    **
+    **  \param[in] writer - reference to a row writer
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void CreateTableInfo(SchemaRowWriter& writer);
+
+    /**
+    **  Creates "rcsb_columninfo" table rows and passes them to a writer,
+    **  without building the table.
+    **
+    **  \param[in] writer - reference to a row writer
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void CreateColumnInfo(SchemaRowWriter& writer);
+
     void GetAttributeNames(vector<string>& attributes,
       const string& tableName);
     void GetMappedAttributesInfo(vector<vector<string> >& mappedAttrInfo,
@@ -247,18 +499,187 @@ class SchemaMap
     void UpdateAttributeDef(const string& tableName, const string& columnName,
       int type, int iWidth, int newWidth);
 
+    /**
+    **  Profiles all the columns of a table, for schema revising. For each
+    **  column that corresponds to a schema attribute, the maximum value
+    **  length and whether the column has any non-null value are
+    **  accumulated into the attribute statistics. This is the bulk
+    **  alternative to calling \e UpdateAttributeDef for each value.
+    **  Profiled statistics are not applied to the schema mapping
+    **  information until \e ApplyColumnProfiles is called.
+    **
+    **  \param[in] table - reference to a table, whose name and column
+    **    names are schema table and attribute names.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void ProfileTableColumns(ISTable& table);
+
+    /**
+    **  Applies the accumulated column statistics to the schema mapping
+    **  information and resets them. Attributes with non-null values are
+    **  marked as populated and string and text attributes get their width
+    **  increased, using the same width rounding as \e UpdateAttributeDef.
+    **
+    **  \param: None
+    **
+    **  \return Number of attributes, whose width has been increased.
+    **
+    **  \pre None
+    **
+    **  \post Column statistics are reset.
+    **
+    **  \exception: None
+    */
+    unsigned int ApplyColumnProfiles();
+
     const vector<AttrInfo>& GetTableAttributeInfo(const string& tableName,
       const vector<string>& columnsNames,
       const Char::eCompareType compareType);
 
     const vector<AttrInfo>& GetAttributesInfo(const string& tableName);
 
+    /**
+    **  Retrieves a column binding plan for a table and a list of its column
+    **  names. Plans are compiled once and cached, keyed by the table name,
+    **  the column names and the compare type, so that tables with the same
+    **  column layout, across any number of files, share the same plan.
+    **  Columns that are not schema attributes are reported in the plan and
+    **  no exception is thrown for them. At most _MAX_BINDING_PLANS plans
+    **  are cached. When a new plan would exceed that limit, all cached
+    **  plans are discarded first.
+    **
+    **  \param[in] tableName - the name of the table
+    **  \param[in] columnsNames - the names of the table columns
+    **  \param[in] compareType - column names compare type
+    **
+    **  \return Reference to the plan, valid until the next call that compiles
+    **    a new plan, or until schema mapping information is re-created.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception EmptyValueException - if table is not a schema table
+    */
+    const BindingPlan& GetBindingPlan(const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType);
+
+    /**
+    **  Utility method, not part of users public API.
+    */
+    static void CompileBindingPlan(BindingPlan& plan,
+      const vector<AttrInfo>& attrInfo, const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType);
+
+    /**
+    **  Utility method, not part of users public API.
+    */
+    static void ApplyBindingPlan(vector<AttrInfo>& aI,
+      const BindingPlan& plan, const vector<AttrInfo>& attrInfo);
+
+    /**
+    **  Utility method, not part of users public API.
+    */
+    static void ResolveTableAttributeInfo(vector<AttrInfo>& aI,
+      const vector<AttrInfo>& attrInfo, const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType);
+
+    /**
+    **  Retrieves the most recently published read-only snapshot of the
+    **  schema mapping information. The snapshot is immutable and can be
+    **  shared and queried by multiple threads without locking. It stays
+    **  valid for as long as the caller holds the returned pointer, even
+    **  if a newer snapshot gets published in the meantime.
+    **
+    **  \param: None
+    **
+    **  \return Pointer to the snapshot, or an empty pointer if no snapshot
+    **    has been published yet.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    std::shared_ptr<const SchemaMapSnapshot> GetSnapshot() const;
+
+    /**
+    **  Creates a snapshot of the current schema mapping information and
+    **  atomically publishes it, replacing the previously published one.
+    **  This is the writer path: it must be called by the thread that owns
+    **  and revises this object (e.g. after \e UpdateAttributeDef or
+    **  \e updateSchemaMapDetails), while readers use \e GetSnapshot().
+    **
+    **  \param: None
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post Snapshot reflects the current schema mapping information.
+    **
+    **  \exception: None
+    */
+    void PublishSnapshot();
+
     static bool AreValuesValid(const vector<string>& row,
       const vector<AttrInfo>& aI);
+
+    /**
+    **  Validates all rows of a table at once, with the same outcome as
+    **  calling \e AreValuesValid for each row. Only the columns, whose
+    **  values are required (key or not null attributes) are checked, column
+    **  by column. The row range can be split across a number of threads.
+    **
+    **  \param[out] rowValid - per row validity flags, 1 if row is valid and
+    **    0 otherwise.
+    **  \param[out] colRejects - per column number of rows, that have been
+    **    rejected due to the empty value in that column.
+    **  \param[in] table - reference to a table
+    **  \param[in] aI - attribute information of the table columns, as
+    **    obtained by \e GetTableAttributeInfo
+    **  \param[in] numThreads - optional parameter that indicates the number
+    **    of threads to use. If not specified, one thread is used.
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static void AreTableValuesValid(vector<unsigned char>& rowValid,
+      vector<unsigned int>& colRejects, ISTable& table,
+      const vector<AttrInfo>& aI, const unsigned int numThreads = 1);
+
+    /**
+    **  Same as above, but for a column-major view of the table values,
+    **  where \e columns[j][i] is the value of column \e j in row \e i.
+    **  All columns must have the same number of values, otherwise
+    **  std::invalid_argument is thrown.
+    */
+    static void AreTableValuesValid(vector<unsigned char>& rowValid,
+      vector<unsigned int>& colRejects,
+      const vector<vector<string> >& columns, const vector<AttrInfo>& aI,
+      const unsigned int numThreads = 1);
     bool IsTablePopulated(const string& tableName);
     void GetMasterIndexAttribName(string& masterIndexAttribName);
 
   private:
+    friend class SchemaMapSnapshot;
+
     bool _verbose;
 
     string _schemaFile;    // Schema definition file name (mmCIF)
@@ -269,6 +690,9 @@ class SchemaMap
     ISTable* _tableSchema;
     ISTable* _attribSchema;
     ISTable* _schemaMap;
+    // Owned copy of "rcsb_attribute_map", with only the rows of the defined
+    // attributes, that _schemaMap points to after reading.
+    ISTable* _filteredSchemaMap;
     ISTable* _mapConditions;
     ISTable* _tableAbbrev;    
     ISTable* _attribAbbrev;
@@ -277,6 +701,9 @@ class SchemaMap
     ISTable* _tableDescr;
     ISTable* _attribView;
 
+    // Whether description and view tables have been dropped in slim mode
+    bool _descrTablesDropped;
+
     bool _reviseSchemaMode;
     int  _compatibilityMode;
 
@@ -292,57 +719,191 @@ class SchemaMap
     ISTable* _itemTab;
     ISTable* _itemAliasesTab;
 
+    SchemaDictIndex* _dictIndex;
+
     string _tableName;
     vector<string> _columnsNames;
     Char::eCompareType _compareType;
     vector<AttrInfo> _aI;
-    vector<AttrInfo> _attrInfo;
+
+    typedef std::unordered_map<string, unsigned int> NameIndex;
+
+    // Attribute catalog, built once from "rcsb_attribute_def". Each table
+    // has its attributes stored contiguously and pre-parsed, together with
+    // the "rcsb_attribute_def" row index of each attribute.
+    NameIndex _catTableIndex;
+    vector<vector<AttrInfo> > _catAttrInfo;
+    vector<vector<unsigned int> > _catAttrRows;
+    vector<NameIndex> _catAttrIndex;
+
+    static const vector<AttrInfo> _emptyAttrInfo;
+
+    typedef std::unordered_map<string, string> NameMap;
+
+    // Abbreviations of table and attribute names, built on first lookup.
+    // First row of a name is the one that is indexed. Marked as not valid
+    // wherever the abbreviation tables are replaced or written.
+    typedef struct
+    {
+        bool valid;
+        NameMap tableAbbrev;
+        std::unordered_map<string, NameMap> attribAbbrev;
+    } AbbrevIndex;
+
+    AbbrevIndex _abbrevIndex;
+
+    typedef std::unordered_multimap<size_t, BindingPlan> BindingPlans;
+
+    // Column binding plans, keyed by signature hash, at most
+    // _MAX_BINDING_PLANS of them
+    BindingPlans _bindingPlans;
+
+    static const unsigned int _MAX_BINDING_PLANS = 4096;
+
+    // Column statistics for schema revising, indexed by
+    // "rcsb_attribute_def" row.
+    vector<unsigned int> _profMaxWidth;
+    vector<unsigned char> _profPopulated;
+
+    std::shared_ptr<const SchemaMapSnapshot> _snapshot;
+
+    static size_t _BindingPlanKey(const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType);
+    static const BindingPlan* _FindBindingPlan(const BindingPlans& plans,
+      const size_t key, const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType);
 
     void _AssignAttribIndices(void);
+    void _DropDescrTables(void);
+    void _LoadDescrTables(void);
+    void _AssignDescrTables(void);
+    void _BuildAttribCatalog(void);
+    void _UpdateAbbrevIndex(void);
+    bool _FindAttribute(unsigned int& tableIndex, unsigned int& attribIndex,
+      const string& tableName, const string& attribName) const;
+    void _SetAttributeValue(const string& tableName, const string& attribName,
+      const string& attributeChange, const string& valueChange);
+    void _SetAttributeValue(const unsigned int tableIndex,
+      const unsigned int attribIndex, const string& attributeChange,
+      const string& valueChange);
     void GetGroupNames(vector<string>& groupNames);
 
     void Clear();
 
-    void UpdateTableDescr(const string& category);
-    void UpdateTableSchema(const string& category);
-    void MapAlias(const string& tableName, const string& colName,
-      const string& op);
-    void GetItemDescription(string& itemDescription,
-      const string& itemName);
-    void GetFirstItemExample(string& firstItemExample,
-      const string& itemName);
-    void GetTopParentName(string& topParentName, const string& itemName);
-    void GetTypeCode(string& typeCode, const string& topParentName,
-      const string& itemName);
-    void GetCategoryKeys(vector<string>& categoryKeys,
-      const string& category);
+    // Rows and log output, created for one category. Categories are
+    // created independently and their rows are appended to the mapping
+    // tables afterwards, in the category order.
+    typedef struct
+    {
+        vector<vector<string> > tableSchema;
+        vector<vector<string> > tableDescr;
+        vector<vector<string> > tableAbbrev;
+        vector<vector<string> > attribSchema;
+        vector<vector<string> > attribDescr;
+        vector<vector<string> > attribView;
+        vector<vector<string> > attribAbbrev;
+        vector<vector<string> > schemaMap;
+
+        std::ostream* out;
+        std::ostream* err;
+        std::ostringstream outBuf;
+        std::ostringstream errBuf;
+
+        // Exception raised while creating the category on a worker
+        // thread, rethrown on the calling thread
+        std::exception_ptr error;
+    } MapRows;
+
+    void _CreateCategory(MapRows& rows, const string& category,
+      const vector<string>& inColNames, const string& op,
+      const string& structId, const bool fromDict) const;
+    void _CreateCategories(vector<MapRows>& allRows,
+      const vector<string>& tableList,
+      const vector<vector<string> >& allColNames, const string& op,
+      const string& structId, const bool fromDict,
+      std::atomic<unsigned int>& nextTableI) const;
+    void _AppendRows(MapRows& rows);
+
+    void UpdateTableDescr(MapRows& rows, const string& category) const;
+    void UpdateTableSchema(MapRows& rows, const string& category) const;
+    void MapAlias(MapRows& rows, const string& tableName,
+      const string& colName, const string& op) const;
+    void GetItemDescription(MapRows& rows, string& itemDescription,
+      const string& itemName) const;
+    void GetFirstItemExample(MapRows& rows, string& firstItemExample,
+      const string& itemName) const;
+    void GetTopParentName(MapRows& rows, string& topParentName,
+      const string& itemName) const;
+    void GetTypeCode(MapRows& rows, string& typeCode,
+      const string& topParentName, const string& itemName) const;
+    void GetCategoryKeys(MapRows& rows, vector<string>& categoryKeys,
+      const string& category) const;
     void CreateMappingTables();
     void WriteMappingTables();
     void GetTablesAndColumns(vector<string>& tableList,
       vector<vector<string> >& allColNames, const string& op,
-      const string& inFile);
+      const vector<string>& inFiles, const unsigned int numThreads);
     void UpdateMapConditions();
 
     void GetDictTables(); 
-    void GetColumnsFromDict(vector<string>& colNames,
-      const string& tableName);
+    void GetColumnsFromDict(MapRows& rows, vector<string>& colNames,
+      const string& tableName) const;
 
-    void AbbrevTableName(string& dbTableNameAbbrev, const string& tableName);
-    void AbbrevColName(const string& tableName, const string& colName);
+    void AbbrevTableName(MapRows& rows, string& dbTableNameAbbrev,
+      const string& tableName) const;
+    void AbbrevColName(MapRows& rows, const string& tableName,
+      const string& colName) const;
 
-    void UpdateAttribSchema(const string& tableName, const string& colName,
-      const unsigned int itype, const vector<string>& categoryKeys);
-    void UpdateAttribView(const string& tableName, const string& colName,
-      const unsigned int itype);
-    void UpdateAttribDescr(const string& tableName, const string& colName);
+    void UpdateAttribSchema(MapRows& rows, const string& tableName,
+      const string& colName, const unsigned int itype,
+      const vector<string>& categoryKeys) const;
+    void UpdateAttribView(MapRows& rows, const string& tableName,
+      const string& colName, const unsigned int itype) const;
+    void UpdateAttribDescr(MapRows& rows, const string& tableName,
+      const string& colName) const;
 
-    void UpdateSchemaMap(const string& tableName, const string& colName,
-      const string& structId);
+    void UpdateSchemaMap(MapRows& rows, const string& tableName,
+      const string& colName, const string& structId) const;
 
-    unsigned int GetTypeCodeIndex(const string& tableName,
-      const string& colName);
+    unsigned int GetTypeCodeIndex(MapRows& rows, const string& tableName,
+      const string& colName) const;
 
     eTypeCode _ConvertDataType(const string& dataType);
+
+    static int _GetRevisedWidth(int newWidth);
+
+    typedef enum
+    {
+        eCHANGE_NONE = 0,
+        eCHANGE_ADDED,
+        eCHANGE_REMOVED,
+        eCHANGE_CHANGED
+    } eChange;
+
+    // Category and item definitions of a dictionary version. Items are
+    // keyed by attribute name.
+    typedef struct
+    {
+        string definition;
+        vector<string> itemNames;
+        NameMap itemDefs;
+    } CatDefs;
+
+    typedef struct
+    {
+        vector<string> catNames;
+        std::unordered_map<string, CatDefs> cats;
+    } DictDefs;
+
+    void _GetDictDefs(DictDefs& dictDefs, const string& dictSdbFileName,
+      const string& op);
+    void _GetStructIdSource(string& structId);
+
+    void _MergeRevisedMaps(vector<unsigned int>& maxWidth,
+      vector<unsigned char>& populated, const vector<string>& revSchemaFiles,
+      std::atomic<unsigned int>& nextFileI, std::exception_ptr& error) const;
 };
 
 #endif
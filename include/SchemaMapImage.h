@@ -0,0 +1,237 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaMapImage.h
+**
+** \brief Header file for SchemaMapImage class.
+*/
+
+
+#ifndef SCHEMAMAPIMAGE_H
+#define SCHEMAMAPIMAGE_H
+
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "GenString.h"
+#include "SchemaMap.h"
+
+
+/**
+**  \class SchemaMapImage
+**
+**  \brief Public class that represents a memory-mapped binary image of
+**    the schema mapping information.
+**
+**  Schema map image is a compact, versioned, binary representation of
+**  the schema mapping information. All strings are interned in a single
+**  string pool, numeric attribute properties are stored pre-parsed and
+**  hash indices for table and attribute lookups are stored prebuilt.
+**  The image file is memory-mapped read-only and queried in place, so
+**  opening it costs no parsing and no heap allocation, and the physical
+**  pages are shared by all processes on a host that map the same file.
+**
+**  The image is created from a schema mapping object, which is obtained
+**  from the ASCII CIF file or the serialized (binary) configuration CIF
+**  file. It answers the same loader queries as SchemaMapStatic, including
+**  the table and column information tables, which are created at image
+**  creation time and stored in it.
+*/
+class SchemaMapImage
+{
+  public:
+    static const uint32_t _VERSION = 2;
+
+    /**
+    **  Attribute record, as stored in the image. String members are
+    **  references into the string pool (see GetString()).
+    */
+    typedef struct
+    {
+        uint32_t name;
+        uint32_t dataType;
+        uint32_t populated;
+        uint32_t abbrev;
+        uint32_t table;
+        int32_t iTypeCode;
+        int32_t iNull;
+        int32_t iWidth;
+        int32_t iPrecision;
+        uint32_t iIndex;
+    } AttribRecord;
+
+    /**
+    **  Writes the schema mapping information of a schema mapping object
+    **  to an image file.
+    **
+    **  \param[in] imageFile - the name of the image file
+    **  \param[in] schemaMap - reference to a schema mapping object, whose
+    **    table and column information tables are created for the image
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if image file cannot be created
+    */
+    static void Create(const string& imageFile, SchemaMap& schemaMap);
+
+    /**
+    **  Fully validates an image file: its structure, checksum and all
+    **  internal references.
+    **
+    **  \param[out] diags - validation diagnostics, empty if image is valid
+    **  \param[in] imageFile - the name of the image file
+    **
+    **  \return true - if image is valid
+    **  \return false - if image is not valid
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static bool Validate(string& diags, const string& imageFile);
+
+    /**
+    **  Constructs a schema map image object, by memory-mapping the image
+    **  file. Only the image structure is checked here, use Validate() for
+    **  the full check. Queries range check the records and references they
+    **  follow, so that an image that is not valid gives incomplete results,
+    **  but is never read out of its bounds.
+    **
+    **  \param[in] imageFile - the name of the image file
+    **
+    **  \return Not applicable
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception NotFoundException - if image file cannot be opened
+    **  \exception InvalidStateException - if image file is not a valid
+    **    schema map image or is of a different version
+    */
+    SchemaMapImage(const string& imageFile);
+
+    ~SchemaMapImage();
+
+    unsigned int GetNumTables() const;
+    const char* GetTableName(const unsigned int tableIndex) const;
+
+    void GetAllTablesNames(vector<string>& tablesNames) const;
+    void GetDataTablesNames(vector<string>& tablesNames) const;
+
+    /**
+    **  Finds a table in the image.
+    **
+    **  \param[out] tableIndex - index of the table, if found
+    **  \param[in] tableName - the name of the table
+    **
+    **  \return true - if table is found
+    **  \return false - if table is not found
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    bool FindTable(unsigned int& tableIndex, const string& tableName) const;
+
+    /**
+    **  Retrieves attribute records of a table, in place.
+    **
+    **  \param[out] numAttribs - number of table attributes
+    **  \param[in] tableIndex - index of the table
+    **
+    **  \return Pointer to the first of \e numAttribs contiguous attribute
+    **    records, valid for the lifetime of this object.
+    **
+    **  \pre \e tableIndex must be smaller than GetNumTables()
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    const AttribRecord* GetAttribs(unsigned int& numAttribs,
+      const unsigned int tableIndex) const;
+
+    const AttribRecord* FindAttribute(const string& tableName,
+      const string& attribName) const;
+
+    const char* GetString(const uint32_t ref) const;
+
+    void GetAttributeNames(vector<string>& attributes,
+      const string& tableName) const;
+    void GetAttributesInfo(vector<AttrInfo>& attrInfo,
+      const string& tableName) const;
+
+    void GetTableAttributeInfo(vector<AttrInfo>& aI, const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType) const;
+
+    /**
+    **  Same as above, but returns a reference to the attributes
+    **  information, as SchemaMap does. The reference is valid until the
+    **  next call of this method in the same thread.
+    */
+    const vector<AttrInfo>& GetTableAttributeInfo(const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType) const;
+
+    void GetMappedAttributesInfo(vector<vector<string> >& mappedAttrInfo,
+      const string& tableName) const;
+    void GetMappedConditions(vector<vector<string> >& mappedConditions,
+      const string& conditionId) const;
+
+    ISTable* CreateTableInfo() const;
+    void CreateTableInfo(SchemaRowWriter& writer) const;
+    ISTable* CreateColumnInfo() const;
+    void CreateColumnInfo(SchemaRowWriter& writer) const;
+
+    void GetTableNameAbbrev(string& abbrevTableName,
+      const string& tableName) const;
+    void GetAttributeNameAbbrev(string& abbrevAttrName,
+      const string& tableName, const string& attribName) const;
+
+    bool IsTablePopulated(const string& tableName) const;
+    void GetMasterIndexAttribName(string& masterIndexAttribName) const;
+
+  private:
+    int _fd;
+    size_t _size;
+    const char* _base;
+
+    const void* _header;
+    const char* _strings;
+    const void* _tables;
+    const AttribRecord* _attribs;
+    const uint32_t* _tableHash;
+    const uint32_t* _attribHash;
+    const void* _maps;
+    const void* _conditions;
+    const uint32_t* _conditionHash;
+    const uint32_t* _tableInfo;
+    const uint32_t* _columnInfo;
+
+    bool _FindConditions(unsigned int& firstCondition,
+      unsigned int& numConditions, const string& conditionId) const;
+    void _WriteRows(SchemaRowWriter& writer, const uint32_t* rows) const;
+
+    SchemaMapImage(const SchemaMapImage&);
+    SchemaMapImage& operator=(const SchemaMapImage&);
+};
+
+
+#endif
@@ -0,0 +1,226 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaMapProgram.h
+**
+** \brief Header file for SchemaMapProgram class.
+*/
+
+
+#ifndef SCHEMAMAPPROGRAM_H
+#define SCHEMAMAPPROGRAM_H
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "GenString.h"
+#include "TableFile.h"
+#include "SchemaMap.h"
+#include "SchemaMapSnapshot.h"
+
+
+/**
+**  \class SchemaMapProgram
+**
+**  \brief Public class that represents the schema mapping information,
+**    compiled into a program that maps CIF data into the target tables.
+**
+**  The program is compiled once, from "rcsb_attribute_map" and
+**  "rcsb_map_condition" information. Source items are referenced by
+**  integer indices, mapping conditions are compiled into predicates and
+**  mapping functions into an enumeration. The program is then executed
+**  on any number of data blocks, without any per row name lookups.
+**
+**  Mapping semantics:
+**    - Target attribute with "datablockid()" function gets the data block
+**      name.
+**    - Target attribute with a mapping condition gets a single value: the
+**      value of its source item in the first source row, which satisfies
+**      all the condition predicates. A predicate compares an item of the
+**      source category with a value, where "datablockid()" value stands
+**      for the data block name.
+**    - Unconditioned source items of a target table are taken row by row
+**      from the driving category, which is the category of the first
+**      unconditioned source item. Target table gets one row per driving
+**      category row. Unconditioned source items of other categories are
+**      treated as single values, taken from their first row.
+**    - Target table without a driving category gets a single row, if any
+**      of its source items is found. Values of missing items and unknown
+**      functions are unknown values.
+**
+**  Program is immutable, so it can be executed by multiple threads.
+*/
+class SchemaMapProgram
+{
+  public:
+    enum eMapFunction
+    {
+        eMAP_FUNCTION_NONE = 0,
+        eMAP_FUNCTION_DATABLOCK_ID,
+        eMAP_FUNCTION_UNKNOWN
+    };
+
+    enum eMapOpType
+    {
+        eMAP_OP_ROW = 0,    // Value from the driving category row
+        eMAP_OP_SCALAR,     // Single value per data block
+        eMAP_OP_FUNCTION,   // Value of a mapping function
+        eMAP_OP_UNKNOWN     // Unknown value
+    };
+
+    /**
+    **  Compiles a schema mapping program.
+    **
+    **  \param[in] snapshot - reference to a schema mapping snapshot
+    **
+    **  \return Not applicable
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    SchemaMapProgram(const SchemaMapSnapshot& snapshot);
+
+    /**
+    **  Compiles a schema mapping program, from a schema mapping object.
+    */
+    SchemaMapProgram(const SchemaMap& schemaMap);
+
+    ~SchemaMapProgram();
+
+    unsigned int GetNumTables() const;
+    const string& GetTableName(const unsigned int tableIndex) const;
+    const vector<string>& GetAttributeNames(
+      const unsigned int tableIndex) const;
+
+    /**
+    **  Finds a target table of the program.
+    **
+    **  \param[out] tableIndex - index of the table, if found
+    **  \param[in] tableName - the name of the table
+    **
+    **  \return true - if table is found
+    **  \return false - if table is not mapped by the program
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    bool FindTable(unsigned int& tableIndex, const string& tableName) const;
+
+    /**
+    **  Executes the program for one target table, on a data block.
+    **
+    **  \param[out] rows - target table rows, with values ordered as in
+    **    GetAttributeNames()
+    **  \param[in] tableIndex - index of the target table
+    **  \param[in] block - reference to a data block
+    **
+    **  \return None
+    **
+    **  \pre \e tableIndex must be smaller than GetNumTables()
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void Execute(vector<vector<string> >& rows, const unsigned int tableIndex,
+      Block& block) const;
+
+    /**
+    **  Executes the program for all target tables, on a data block, and
+    **  passes the rows of target tables, that get rows, to a writer.
+    **
+    **  \param[in] writer - reference to a row writer
+    **  \param[in] block - reference to a data block
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void Execute(SchemaRowWriter& writer, Block& block) const;
+
+  private:
+    typedef struct
+    {
+        unsigned int category;
+        string itemName;
+    } SourceItem;
+
+    typedef struct
+    {
+        unsigned int item;
+        bool isDatablockId;
+        string value;
+    } Predicate;
+
+    typedef struct
+    {
+        unsigned int item;
+        vector<Predicate> predicates;
+    } Scalar;
+
+    typedef struct
+    {
+        eMapOpType type;
+        unsigned int index;  // Source item, scalar or function
+    } MapOp;
+
+    typedef struct
+    {
+        string name;
+        vector<string> attribNames;
+        int drivingCategory;
+        vector<MapOp> ops;
+    } TargetTable;
+
+    // Source data of a data block, loaded for one program execution
+    typedef struct
+    {
+        vector<unsigned int> numRows;  // Per category
+        vector<vector<string> > columns;  // Per item, empty if missing
+        vector<unsigned char> loaded;  // Per item
+        vector<const string*> scalars;  // Per scalar, NULL if not evaluated
+    } BlockData;
+
+    vector<string> _categories;
+    vector<SourceItem> _items;
+    vector<Scalar> _scalars;
+    vector<TargetTable> _tables;
+
+    typedef std::unordered_map<string, unsigned int> NameIndex;
+
+    NameIndex _tableIndex;
+
+    void _Compile(const SchemaMapSnapshot& snapshot);
+    unsigned int _GetItem(NameIndex& itemIndex, NameIndex& categoryIndex,
+      const string& categoryName, const string& itemName);
+
+    void _InitBlockData(BlockData& data) const;
+    void _LoadItem(BlockData& data, const unsigned int item,
+      Block& block) const;
+    const string& _GetScalar(BlockData& data, const unsigned int scalar,
+      Block& block) const;
+    void _Execute(vector<vector<string> >& rows, const TargetTable& table,
+      BlockData& data, Block& block) const;
+
+    SchemaMapProgram(const SchemaMapProgram&);
+    SchemaMapProgram& operator=(const SchemaMapProgram&);
+};
+
+
+#endif
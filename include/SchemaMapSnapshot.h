@@ -0,0 +1,155 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaMapSnapshot.h
+**
+** \brief Header file for SchemaMapSnapshot class.
+*/
+
+
+#ifndef SCHEMAMAPSNAPSHOT_H
+#define SCHEMAMAPSNAPSHOT_H
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include "GenString.h"
+#include "SchemaMap.h"
+
+
+/**
+**  \class SchemaMapSnapshot
+**
+**  \brief Public class that represents an immutable copy of the schema
+**    mapping information.
+**
+**  This class holds a read-only copy of the schema mapping information
+**  of a schema mapping object, taken at the time the snapshot was
+**  published (see SchemaMap::PublishSnapshot()). All its methods are
+**  const, so a single snapshot can be queried by multiple threads
+**  concurrently. Column binding plans are compiled when the snapshot is
+**  built and are read without locking. Only plans of column lists, that
+**  were not known at that time, are compiled on first use and cached
+**  under a lock. References returned by the snapshot stay valid for the
+**  lifetime of the snapshot.
+*/
+class SchemaMapSnapshot
+{
+  public:
+    /**
+    **  Constructs a snapshot of a schema mapping object.
+    **
+    **  \param[in] schemaMap - reference to a schema mapping object, whose
+    **    information is copied.
+    **
+    **  \return Not applicable
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    SchemaMapSnapshot(const SchemaMap& schemaMap);
+
+    ~SchemaMapSnapshot();
+
+    void GetAllTablesNames(vector<string>& tablesNames) const;
+    void GetDataTablesNames(vector<string>& tablesNames) const;
+
+    void GetAttributeNames(vector<string>& attributes,
+      const string& tableName) const;
+
+    /**
+    **  Retrieves attributes information of a table.
+    **
+    **  \param[in] tableName - the name of the table
+    **
+    **  \return Reference to the attributes information, which is valid for
+    **    the lifetime of the snapshot. Empty if table is not defined.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    const vector<AttrInfo>& GetAttributesInfo(const string& tableName) const;
+
+    /**
+    **  Retrieves attributes information of the table attributes, ordered
+    **  as the specified columns.
+    **
+    **  \param[out] aI - retrieved attributes information, one per column
+    **  \param[in] tableName - the name of the table
+    **  \param[in] columnsNames - the names of the columns
+    **  \param[in] compareType - column names comparison type
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception EmptyValueException - if table name or columns names are
+    **    empty or if table has no attributes.
+    */
+    void GetTableAttributeInfo(vector<AttrInfo>& aI, const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType) const;
+
+    void GetMappedAttributesInfo(vector<vector<string> >& mappedAttrInfo,
+      const string& tableName) const;
+    void GetMappedConditions(vector<vector<string> >& mappedConditions,
+      const string& tableName) const;
+
+    void GetTableNameAbbrev(string& abbrevTableName,
+      const string& tableName) const;
+    void GetAttributeNameAbbrev(string& abbrevAttrName,
+      const string& tableName, const string& attribName) const;
+
+    bool IsTablePopulated(const string& tableName) const;
+    void GetMasterIndexAttribName(string& masterIndexAttribName) const;
+
+  private:
+    typedef std::unordered_map<string, unsigned int> NameIndex;
+    typedef std::unordered_map<string, string> NameMap;
+    typedef std::unordered_map<string, vector<vector<string> > > RowsMap;
+
+    vector<string> _tablesNames;
+
+    NameIndex _tableIndex;
+    vector<vector<AttrInfo> > _attrInfo;
+
+    RowsMap _mappedAttrInfo;
+    RowsMap _mappedConditions;
+
+    NameMap _tableAbbrev;
+    std::unordered_map<string, NameMap> _attribAbbrev;
+
+    string _masterIndexAttribName;
+
+    // Binding plans of the tables attributes and the ones already compiled
+    // by the schema mapping object. Never changed after construction.
+    SchemaMap::BindingPlans _bindingPlans;
+
+    // Binding plans compiled after construction, at most
+    // SchemaMap::_MAX_BINDING_PLANS of them, guarded by _missPlansMutex
+    mutable SchemaMap::BindingPlans _missPlans;
+    mutable std::mutex _missPlansMutex;
+
+    static const vector<AttrInfo> _emptyAttrInfo;
+
+    SchemaMapSnapshot(const SchemaMapSnapshot&);
+    SchemaMapSnapshot& operator=(const SchemaMapSnapshot&);
+};
+
+
+#endif
@@ -0,0 +1,397 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaMapStatic.h
+**
+** \brief Header file for SchemaMapStatic class and the compiled schema
+**   mapping information types.
+*/
+
+
+#ifndef SCHEMAMAPSTATIC_H
+#define SCHEMAMAPSTATIC_H
+
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include "GenString.h"
+#include "SchemaMap.h"
+
+
+/**
+**  Compiled attribute definition, i.e. a row of "rcsb_attribute_def"
+**  table, with its type code resolved and its abbreviation.
+*/
+typedef struct
+{
+    const char* attribName;
+    const char* attribAbbrev;
+    const char* dataType;
+    eTypeCode typeCode;
+    bool index;
+    int null;
+    int width;
+    int precision;
+    const char* populated;
+} StaticAttrInfo;
+
+
+/**
+**  Compiled attribute mapping, i.e. a row of "rcsb_attribute_map" table.
+*/
+typedef struct
+{
+    const char* targetAttribName;
+    const char* sourceItemName;
+    const char* conditionId;
+    const char* functionId;
+} StaticMapInfo;
+
+
+/**
+**  Compiled mapping condition, i.e. a row of "rcsb_map_condition" table.
+*/
+typedef struct
+{
+    const char* conditionId;
+    const char* attribName;
+    const char* attribValue;
+} StaticConditionInfo;
+
+
+/**
+**  Compiled table definition. Table attributes are stored contiguously,
+**  starting at \e firstAttrib, and so are its attribute mappings,
+**  starting at \e firstMap.
+*/
+typedef struct
+{
+    const char* tableName;
+    const char* tableAbbrev;
+    unsigned int firstAttrib;
+    unsigned int numAttribs;
+    unsigned int firstMap;
+    unsigned int numMaps;
+} StaticTableInfo;
+
+
+/**
+**  Compiled rows of a created table. \e values holds \e numColumns
+**  values of each of the \e numRows rows, one row after the other.
+*/
+typedef struct
+{
+    const char* tableName;
+    const char* const* columnsNames;
+    unsigned int numColumns;
+    const char* const* values;
+    unsigned int numRows;
+} StaticRowsInfo;
+
+
+/**
+**  Compiled schema mapping information, as generated by SchemaMapCodeGen.
+**  \e tablesByName holds table indices, ordered by table name.
+**  \e attribsByName holds, for each table at the positions of its
+**  attributes, attribute indices, ordered by attribute name.
+**  \e conditions are ordered by condition identifier. Names are ordered
+**  by their bytes and names that are defined more than once keep their
+**  definition order. \e tableInfo and \e columnInfo hold the rows of
+**  the table and column info tables, as created by SchemaMap.
+*/
+typedef struct
+{
+    const StaticTableInfo* tables;
+    unsigned int numTables;
+    const unsigned int* tablesByName;
+    const StaticAttrInfo* attribs;
+    unsigned int numAttribs;
+    const unsigned int* attribsByName;
+    const StaticMapInfo* maps;
+    unsigned int numMaps;
+    const StaticConditionInfo* conditions;
+    unsigned int numConditions;
+    StaticRowsInfo tableInfo;
+    StaticRowsInfo columnInfo;
+    const char* masterIndexAttribName;
+} StaticSchemaMapData;
+
+
+/**
+**  \class SchemaMapStatic
+**
+**  \brief Public class that represents compiled schema mapping
+**    information.
+**
+**  This class provides the queries, that loaders make on the schema
+**  mapping object, over the schema mapping information, that has been
+**  compiled into constant tables by SchemaMapCodeGen, so that it can
+**  replace the schema mapping object in loaders. Nothing is read or parsed
+**  at construction time and attributes information of a table is only
+**  created on its first use. Like snapshots (see SchemaMapSnapshot),
+**  objects of this class can be queried by multiple threads concurrently.
+**
+**  Table, attribute and condition lookups are binary searches and are
+**  available as constexpr functions, so that they can be resolved at
+**  compile time, when the names are known.
+*/
+class SchemaMapStatic
+{
+  public:
+    /**
+    **  Constructs an adapter over compiled schema mapping information.
+    **
+    **  \param[in] data - reference to the compiled schema mapping
+    **    information, which must outlive the object.
+    **
+    **  \return Not applicable
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    SchemaMapStatic(const StaticSchemaMapData& data);
+
+    ~SchemaMapStatic();
+
+    const StaticSchemaMapData& GetData() const;
+
+    void GetAllTablesNames(vector<string>& tablesNames) const;
+    void GetDataTablesNames(vector<string>& tablesNames) const;
+
+    void GetAttributeNames(vector<string>& attributes,
+      const string& tableName) const;
+
+    /**
+    **  Retrieves attributes information of a table.
+    **
+    **  \param[in] tableName - the name of the table
+    **
+    **  \return Reference to the attributes information, which is valid for
+    **    the lifetime of the object. Empty if table is not defined.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    const vector<AttrInfo>& GetAttributesInfo(const string& tableName) const;
+
+    void GetTableAttributeInfo(vector<AttrInfo>& aI, const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType) const;
+
+    /**
+    **  Same as above, but returns a reference to the attributes
+    **  information, as SchemaMap does. The reference is valid until the
+    **  next call of this method in the same thread.
+    */
+    const vector<AttrInfo>& GetTableAttributeInfo(const string& tableName,
+      const vector<string>& columnsNames,
+      const Char::eCompareType compareType) const;
+
+    void GetMappedAttributesInfo(vector<vector<string> >& mappedAttrInfo,
+      const string& tableName) const;
+    void GetMappedConditions(vector<vector<string> >& mappedConditions,
+      const string& conditionId) const;
+
+    ISTable* CreateTableInfo() const;
+    void CreateTableInfo(SchemaRowWriter& writer) const;
+    ISTable* CreateColumnInfo() const;
+    void CreateColumnInfo(SchemaRowWriter& writer) const;
+
+    void GetTableNameAbbrev(string& abbrevTableName,
+      const string& tableName) const;
+    void GetAttributeNameAbbrev(string& abbrevAttrName,
+      const string& tableName, const string& attribName) const;
+
+    bool IsTablePopulated(const string& tableName) const;
+    void GetMasterIndexAttribName(string& masterIndexAttribName) const;
+
+    /**
+    **  Compares two names by their bytes.
+    **
+    **  \param[in] s1 - the first name
+    **  \param[in] s2 - the second name
+    **
+    **  \return Negative, zero or positive value if \e s1 is less than,
+    **    equal to or greater than \e s2.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static constexpr int Compare(const char* s1, const char* s2)
+    {
+        return (((*s1 != *s2) || (*s1 == '\0')) ?
+          ((int)(unsigned char)*s1 - (int)(unsigned char)*s2) :
+          Compare(s1 + 1, s2 + 1));
+    }
+
+    /**
+    **  Finds a table.
+    **
+    **  \param[in] data - reference to the compiled schema mapping
+    **    information
+    **  \param[in] tableName - the name of the table
+    **
+    **  \return Index of the table in \e data.tables, or -1 if table is not
+    **    defined.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static constexpr int FindTable(const StaticSchemaMapData& data,
+      const char* tableName)
+    {
+        return (_FoundTable(data, tableName,
+          _TableLowerBound(data, tableName, 0, data.numTables)));
+    }
+
+    /**
+    **  Finds an attribute of a table.
+    **
+    **  \param[in] data - reference to the compiled schema mapping
+    **    information
+    **  \param[in] tableIndex - index of the table, as returned by
+    **    \e FindTable
+    **  \param[in] attribName - the name of the attribute
+    **
+    **  \return Index of the attribute in \e data.attribs, or -1 if
+    **    attribute is not defined.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static constexpr int FindAttribute(const StaticSchemaMapData& data,
+      const int tableIndex, const char* attribName)
+    {
+        return (((tableIndex < 0) ||
+          ((unsigned int)tableIndex >= data.numTables)) ? -1 :
+          _FoundAttribute(data, tableIndex, attribName,
+          _AttribLowerBound(data, attribName,
+          data.tables[tableIndex].firstAttrib,
+          data.tables[tableIndex].firstAttrib +
+          data.tables[tableIndex].numAttribs)));
+    }
+
+    /**
+    **  Finds the first row of a mapping condition.
+    **
+    **  \param[in] data - reference to the compiled schema mapping
+    **    information
+    **  \param[in] conditionId - the identifier of the condition
+    **
+    **  \return Index of the first row of the condition in
+    **    \e data.conditions, or -1 if condition is not defined. Rows of a
+    **    condition are consecutive.
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static constexpr int FindCondition(const StaticSchemaMapData& data,
+      const char* conditionId)
+    {
+        return (_FoundCondition(data, conditionId,
+          _ConditionLowerBound(data, conditionId, 0, data.numConditions)));
+    }
+
+  private:
+    const StaticSchemaMapData& _data;
+
+    // Attributes information of each table, created on its first use
+    mutable vector<vector<AttrInfo> > _attrInfo;
+    std::unique_ptr<std::once_flag[]> _attrInfoOnce;
+
+    static const vector<AttrInfo> _emptyAttrInfo;
+
+    void _CreateAttributesInfo(const unsigned int tableIndex) const;
+
+    static void _WriteRows(SchemaRowWriter& writer,
+      const StaticRowsInfo& rowsInfo);
+
+    static constexpr unsigned int _TableLowerBound(
+      const StaticSchemaMapData& data, const char* tableName,
+      const unsigned int low, const unsigned int high)
+    {
+        return ((low >= high) ? low :
+          (Compare(data.tables[data.tablesByName[(low + high) / 2]].tableName,
+          tableName) < 0) ?
+          _TableLowerBound(data, tableName, (low + high) / 2 + 1, high) :
+          _TableLowerBound(data, tableName, low, (low + high) / 2));
+    }
+
+    static constexpr int _FoundTable(const StaticSchemaMapData& data,
+      const char* tableName, const unsigned int pos)
+    {
+        return (((pos < data.numTables) &&
+          (Compare(data.tables[data.tablesByName[pos]].tableName,
+          tableName) == 0)) ? (int)data.tablesByName[pos] : -1);
+    }
+
+    static constexpr unsigned int _AttribLowerBound(
+      const StaticSchemaMapData& data, const char* attribName,
+      const unsigned int low, const unsigned int high)
+    {
+        return ((low >= high) ? low :
+          (Compare(data.attribs[data.attribsByName[(low + high) / 2]].attribName,
+          attribName) < 0) ?
+          _AttribLowerBound(data, attribName, (low + high) / 2 + 1, high) :
+          _AttribLowerBound(data, attribName, low, (low + high) / 2));
+    }
+
+    static constexpr int _FoundAttribute(const StaticSchemaMapData& data,
+      const int tableIndex, const char* attribName, const unsigned int pos)
+    {
+        return (((pos < data.tables[tableIndex].firstAttrib +
+          data.tables[tableIndex].numAttribs) &&
+          (Compare(data.attribs[data.attribsByName[pos]].attribName,
+          attribName) == 0)) ? (int)data.attribsByName[pos] : -1);
+    }
+
+    static constexpr unsigned int _ConditionLowerBound(
+      const StaticSchemaMapData& data, const char* conditionId,
+      const unsigned int low, const unsigned int high)
+    {
+        return ((low >= high) ? low :
+          (Compare(data.conditions[(low + high) / 2].conditionId,
+          conditionId) < 0) ?
+          _ConditionLowerBound(data, conditionId, (low + high) / 2 + 1, high) :
+          _ConditionLowerBound(data, conditionId, low, (low + high) / 2));
+    }
+
+    static constexpr int _FoundCondition(const StaticSchemaMapData& data,
+      const char* conditionId, const unsigned int pos)
+    {
+        return (((pos < data.numConditions) &&
+          (Compare(data.conditions[pos].conditionId, conditionId) == 0)) ?
+          (int)pos : -1);
+    }
+
+    SchemaMapStatic(const SchemaMapStatic&);
+    SchemaMapStatic& operator=(const SchemaMapStatic&);
+};
+
+
+#endif
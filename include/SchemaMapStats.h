@@ -0,0 +1,272 @@
+/*$$FILE$$*/
+/*$$VERSION$$*/
+/*$$DATE$$*/
+/*$$LICENSE$$*/
+
+
+/*!
+** \file SchemaMapStats.h
+**
+** \brief Header file for SchemaMapStats class.
+*/
+
+
+#ifndef SCHEMAMAPSTATS_H
+#define SCHEMAMAPSTATS_H
+
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <atomic>
+#include <chrono>
+
+#include "GenString.h"
+
+
+typedef enum
+{
+    eCOUNTER_GET_ATTRIBUTES_INFO = 0,
+    eCOUNTER_GET_TABLE_ATTRIBUTE_INFO,
+    eCOUNTER_TABLE_CACHE_HIT,      // SchemaMap last table cache
+    eCOUNTER_TABLE_CACHE_MISS,
+    eCOUNTER_BINDING_PLAN_HIT,
+    eCOUNTER_BINDING_PLAN_MISS,
+    eCOUNTER_GET_CAT_KEYS,
+    eCOUNTER_IS_CAT_DEFINED,
+    eCOUNTER_IS_ITEM_DEFINED,
+    eCOUNTER_TABLE_SEARCH,         // ISTable::Search() calls
+    eCOUNTER_ROWS_VALIDATED,
+    eCOUNTER_ROWS_REJECTED,
+    eCOUNTER_WIDTH_REVISIONS,
+    eNUM_COUNTERS
+} eSchemaMapCounter;
+
+
+typedef enum
+{
+    eTIMER_LOAD = 0,
+    eTIMER_CREATE,
+    eTIMER_UPDATE_DETAILS,
+    eTIMER_TABLE_INFO,
+    eTIMER_COLUMN_INFO,
+    eTIMER_VALIDATE_TABLE,
+    eTIMER_REGENERATE,
+    eNUM_TIMERS
+} eSchemaMapTimer;
+
+
+typedef enum
+{
+    eLOG_DEBUG = 0,
+    eLOG_INFO,
+    eLOG_WARNING
+} eSchemaMapLogLevel;
+
+
+/**
+**  \class SchemaMapLogSink
+**
+**  \brief Public interface of a consumer of the schema map log messages.
+**
+**  Messages are single lines, without the line terminator. Sink can be
+**  called by multiple threads at the same time.
+*/
+class SchemaMapLogSink
+{
+  public:
+    virtual ~SchemaMapLogSink() {};
+
+    virtual void Write(const eSchemaMapLogLevel level,
+      const string& message) = 0;
+};
+
+
+/**
+**  \class SchemaMapStats
+**
+**  \brief Public class that represents the schema map instrumentation:
+**    counters, timers and the log.
+**
+**  Counters and timers are kept per thread, so updating them costs one
+**  relaxed load and store of a thread local value, without any locking
+**  or shared cache lines. A snapshot sums the values of all the threads,
+**  including the threads that have already exited. If the library is
+**  compiled with SCHEMA_MAP_NO_STATS defined, counters and timers are
+**  compiled out and snapshots are all zeros.
+**
+**  Log messages of the library are passed to a log sink. By default,
+**  debug and info messages are written to the standard output and
+**  warnings to the standard error.
+*/
+class SchemaMapStats
+{
+  public:
+    typedef struct
+    {
+        vector<uint64_t> counters;
+        vector<uint64_t> timerCalls;
+        vector<uint64_t> timerNanosecs;
+        unsigned int numThreads;
+    } Snapshot;
+
+    static bool IsEnabled();
+
+    static void Count(const eSchemaMapCounter counter,
+      const uint64_t value = 1);
+    static void AddTime(const eSchemaMapTimer timer, const uint64_t nanosecs);
+
+    /**
+    **  Retrieves the sum of the counters and timers of all the threads.
+    **
+    **  \param[out] snapshot - counters and timers, indexed by
+    **    eSchemaMapCounter and eSchemaMapTimer
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static void GetSnapshot(Snapshot& snapshot);
+
+    static void Reset();
+
+    /**
+    **  Writes a snapshot, in JSON format.
+    **
+    **  \param[in] out - reference to an output stream
+    **  \param[in] snapshot - reference to a snapshot
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static void WriteJson(std::ostream& out, const Snapshot& snapshot);
+    static void WriteJson(std::ostream& out);
+
+    static const char* GetCounterName(const eSchemaMapCounter counter);
+    static const char* GetTimerName(const eSchemaMapTimer timer);
+
+    /**
+    **  Sets the log sink.
+    **
+    **  \param[in] sink - pointer to the log sink, which must outlive its
+    **    use, or NULL to restore the default log sink
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    static void SetLogSink(SchemaMapLogSink* sink);
+
+    static void Log(const eSchemaMapLogLevel level, const string& message);
+
+    /**
+    **  Logs each line of a text, that is terminated by a new line.
+    */
+    static void LogLines(const eSchemaMapLogLevel level, const string& text);
+
+  private:
+    friend class ThreadStatsRetirer;
+
+    typedef struct
+    {
+        std::atomic<uint64_t> counters[eNUM_COUNTERS];
+        std::atomic<uint64_t> timerCalls[eNUM_TIMERS];
+        std::atomic<uint64_t> timerNanosecs[eNUM_TIMERS];
+    } ThreadStats;
+
+    static thread_local ThreadStats* _threadStats;
+
+    static ThreadStats& _GetThreadStats();
+    static ThreadStats* _RegisterThread();
+    static void _RetireThread(void* threadStats);
+};
+
+
+/**
+**  \class SchemaMapStatsTimer
+**
+**  \brief Adds the time between its construction and destruction to a
+**    schema map timer.
+*/
+class SchemaMapStatsTimer
+{
+  public:
+#ifndef SCHEMA_MAP_NO_STATS
+    SchemaMapStatsTimer(const eSchemaMapTimer timer) : _timer(timer),
+      _start(std::chrono::steady_clock::now()) {};
+
+    ~SchemaMapStatsTimer()
+    {
+        SchemaMapStats::AddTime(_timer,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - _start).count());
+    };
+
+  private:
+    eSchemaMapTimer _timer;
+    std::chrono::steady_clock::time_point _start;
+#else
+    SchemaMapStatsTimer(const eSchemaMapTimer timer) {};
+#endif
+
+    SchemaMapStatsTimer(const SchemaMapStatsTimer&);
+    SchemaMapStatsTimer& operator=(const SchemaMapStatsTimer&);
+};
+
+
+inline SchemaMapStats::ThreadStats& SchemaMapStats::_GetThreadStats()
+{
+    if (_threadStats == NULL)
+    {
+        _threadStats = _RegisterThread();
+    }
+
+    return (*_threadStats);
+}
+
+
+inline void SchemaMapStats::Count(const eSchemaMapCounter counter,
+  const uint64_t value)
+{
+#ifndef SCHEMA_MAP_NO_STATS
+    // Only this thread writes the value, so no read-modify-write is needed
+    std::atomic<uint64_t>& v = _GetThreadStats().counters[counter];
+    v.store(v.load(std::memory_order_relaxed) + value,
+      std::memory_order_relaxed);
+#endif
+}
+
+
+inline void SchemaMapStats::AddTime(const eSchemaMapTimer timer,
+  const uint64_t nanosecs)
+{
+#ifndef SCHEMA_MAP_NO_STATS
+    ThreadStats& stats = _GetThreadStats();
+
+    std::atomic<uint64_t>& calls = stats.timerCalls[timer];
+    calls.store(calls.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+
+    std::atomic<uint64_t>& time = stats.timerNanosecs[timer];
+    time.store(time.load(std::memory_order_relaxed) + nanosecs,
+      std::memory_order_relaxed);
+#endif
+}
+
+
+#endif
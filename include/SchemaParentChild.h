@@ -15,17 +15,153 @@
 #define SCHEMAPARENTCHILD_H
 
 
+#include <string>
+#include <vector>
+
 #include "DictObjCont.h"
 #include "DictParentChild.h"
 #include "SchemaDataInfo.h"
 
 
+/**
+**  \class SchemaParentChild
+**
+**  \brief Parent/child relationships of the mapped schema.
+**
+**  At construction, the dictionary parent/child item links, restricted to
+**  the items of the mapped schema, are built into compact (CSR) adjacency
+**  graphs of items and of categories, so that parent/child queries cost
+**  O(degree). Item and category IDs are the ones of SchemaDataInfo.
+**
+**  Categories are also ordered into layers: parents of a category are
+**  all in the earlier layers, so tables of one layer are independent and
+**  can be loaded concurrently, once all the earlier layers are loaded.
+**  Categories that are in, or depend on, a parent/child cycle have no
+**  such order. They are not in any layer and are retrieved separately,
+**  with GetCycleCats().
+*/
 class SchemaParentChild : public DictParentChild
 {
   public:
     SchemaParentChild(SchemaDataInfo& schemaDataInfo,
       const DictObjCont& dictObjCont);
     virtual ~SchemaParentChild();
+
+    /**
+    **  Retrieves IDs of the parent items of an item.
+    **
+    **  \param[out] numParents - number of parent items
+    **  \param[in] itemId - ID of the item
+    **
+    **  \return Pointer to the first of \e numParents contiguous item IDs,
+    **    valid for the lifetime of this object.
+    **
+    **  \pre \e itemId must be a valid SchemaDataInfo item ID
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    const unsigned int* GetItemParentIds(unsigned int& numParents,
+      const unsigned int itemId) const;
+    const unsigned int* GetItemChildIds(unsigned int& numChildren,
+      const unsigned int itemId) const;
+
+    const unsigned int* GetCatParentIds(unsigned int& numParents,
+      const unsigned int catId) const;
+    const unsigned int* GetCatChildIds(unsigned int& numChildren,
+      const unsigned int catId) const;
+
+    void GetParentItems(std::vector<std::string>& parCifItems,
+      const std::string& cifItemName) const;
+    void GetChildItems(std::vector<std::string>& childCifItems,
+      const std::string& cifItemName) const;
+
+    void GetParentCats(std::vector<std::string>& parCatNames,
+      const std::string& catName) const;
+    void GetChildCats(std::vector<std::string>& childCatNames,
+      const std::string& catName) const;
+
+    /**
+    **  Retrieves the category load layers. Categories returned by
+    **  GetCycleCats() are not in any layer.
+    **
+    **  \param[out] layers - category names, per layer, in load order
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void GetCatLayers(std::vector<std::vector<std::string> >& layers) const;
+
+    /**
+    **  Retrieves the categories that are in, or depend on, a parent/child
+    **  cycle. Their tables depend on each other in no particular order, so
+    **  they are to be loaded one at a time, after all the layers.
+    **
+    **  \param[out] catNames - category names
+    **
+    **  \return None
+    **
+    **  \pre None
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    void GetCycleCats(std::vector<std::string>& catNames) const;
+
+    unsigned int GetNumCatLayers() const;
+
+    /**
+    **  Retrieves the layer of a category.
+    **
+    **  \param[in] catId - ID of the category
+    **
+    **  \return Layer of the category, or GetNumCatLayers() if the category
+    **    is in, or depends on, a parent/child cycle.
+    **
+    **  \pre \e catId must be a valid SchemaDataInfo category ID
+    **
+    **  \post None
+    **
+    **  \exception: None
+    */
+    unsigned int GetCatLayer(const unsigned int catId) const;
+
+    bool HasCycles() const;
+
+  private:
+    typedef struct
+    {
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> targets;
+    } Adjacency;
+
+    SchemaDataInfo& _schemaDataInfo;
+
+    Adjacency _itemParents;
+    Adjacency _itemChildren;
+    Adjacency _catParents;
+    Adjacency _catChildren;
+
+    std::vector<unsigned int> _catLayers;
+    unsigned int _numCatLayers;
+    std::vector<unsigned int> _cycleCatIds;
+    bool _hasCycles;
+
+    void _BuildCatLayers();
+
+    static void _BuildAdjacency(Adjacency& adjacency,
+      const unsigned int numNodes,
+      const std::vector<std::pair<unsigned int, unsigned int> >& edges,
+      const bool reverse);
+    static const unsigned int* _GetTargets(unsigned int& numTargets,
+      const Adjacency& adjacency, const unsigned int node);
 };
 
 